@@ -0,0 +1,106 @@
+// Radar render benchmark: frame time against number of filled angle bins
+const BENCH_POINT_COUNTS = [0, 30, 60, 90, 120, 150, 181];
+const BENCH_FRAMES = 120;
+
+let benchRunning = false;
+
+// Fill `count` bins spread evenly over the sweep, returns the filled bins
+function fillBenchBins(count) {
+    clearRadarData();
+    const bins = [];
+    for (let i = 0; i < count; i++) {
+        const bin = Math.floor((i * RADAR_BINS) / count);
+        setRadarBin(bin, 20 + Math.random() * (RADAR_MAX_RANGE - 20));
+        bins.push(bin);
+    }
+    drawRadar();
+    return bins;
+}
+
+// Previous behaviour: redraw grid and replay every point each frame
+function drawRadarFull() {
+    drawRadarBackground(ctx);
+    for (let bin = 0; bin < RADAR_BINS; bin++) {
+        if (radarDistances[bin] > 0) {
+            drawRadarPoint(ctx, bin);
+        }
+    }
+    drawSweepLine();
+    
+    radarDirtyFlags.fill(0);
+    radarDirtyCount = 0;
+}
+
+// Render BENCH_FRAMES frames, each with one new sample, and time them
+function runBenchMode(count, full) {
+    const bins = fillBenchBins(count);
+    
+    return new Promise(resolve => {
+        let frame = 0;
+        let total = 0, max = 0;
+        let firstStamp = 0, lastStamp = 0;
+        
+        function step(timestamp) {
+            if (frame === 0) firstStamp = timestamp;
+            lastStamp = timestamp;
+            
+            // Simulate one radar sample per frame, as the live sweep does
+            sweepAngle = frame % RADAR_BINS;
+            if (bins.length > 0) {
+                setRadarBin(bins[frame % bins.length], 20 + Math.random() * (RADAR_MAX_RANGE - 20));
+            }
+            
+            const start = performance.now();
+            if (full) {
+                drawRadarFull();
+            } else {
+                drawRadar();
+            }
+            const elapsed = performance.now() - start;
+            total += elapsed;
+            max = Math.max(max, elapsed);
+            
+            if (++frame < BENCH_FRAMES) {
+                requestAnimationFrame(step);
+            } else {
+                resolve({
+                    avg: total / BENCH_FRAMES,
+                    max: max,
+                    interval: (lastStamp - firstStamp) / (BENCH_FRAMES - 1)
+                });
+            }
+        }
+        requestAnimationFrame(step);
+    });
+}
+
+async function runBenchmark() {
+    if (benchRunning || !ctx) return;
+    benchRunning = true;
+    
+    const status = document.getElementById('bench-status');
+    const results = document.getElementById('bench-results');
+    results.innerHTML = '';
+    
+    // Block the live render loop so only timed frames touch the canvas
+    radarFrameRequested = true;
+    
+    for (const count of BENCH_POINT_COUNTS) {
+        status.textContent = `Running ${count} points...`;
+        const incremental = await runBenchMode(count, false);
+        const full = await runBenchMode(count, true);
+        
+        const row = document.createElement('tr');
+        row.innerHTML = `<td>${count}</td>` +
+            `<td>${incremental.avg.toFixed(3)} / ${incremental.max.toFixed(3)}</td>` +
+            `<td>${full.avg.toFixed(3)} / ${full.max.toFixed(3)}</td>` +
+            `<td>${incremental.interval.toFixed(1)} / ${full.interval.toFixed(1)}</td>`;
+        results.appendChild(row);
+        console.log('Benchmark', count, 'points:', incremental, full);
+    }
+    
+    radarFrameRequested = false;
+    clearRadarData();
+    status.textContent = 'Done';
+    benchRunning = false;
+}
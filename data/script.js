@@ -1,23 +1,41 @@
 // Global variables
 let radarActive = false;
-let radarData = [];
 let sweepAngle = 90; // Start at center (90°)
 let canvas, ctx;
 
+// Radar store: one bin per servo degree (0-180°), distance 0 = empty bin
+const RADAR_BINS = 181;
+const RADAR_MAX_RANGE = 400; // cm
+let radarDistances = new Float32Array(RADAR_BINS);
+let radarDirtyBins = new Uint16Array(RADAR_BINS); // Queue of bins changed since last frame
+let radarDirtyFlags = new Uint8Array(RADAR_BINS);
+let radarDirtyCount = 0;
+let radarBinRects = new Float32Array(RADAR_BINS * 4); // x, y, w, h drawn on points layer (w = 0: nothing)
+
+// Render layers: static background drawn once, points updated per changed bin
+let bgCanvas, pointsCanvas, pointsCtx;
+let sweepGradient;
+let radarFrameRequested = false;
+let renderedSweepAngle = -1; // -1 forces the next frame to redraw
+let radarCenterX, radarCenterY, radarMaxRadius; // Canvas size is fixed, computed once
+
 // Initialize when page loads
 document.addEventListener('DOMContentLoaded', function() {
     // Initialize slider for square movement
     const slider = document.getElementById('square-size');
     const sizeValue = document.getElementById('size-value');
     
-    slider.addEventListener('input', function() {
-        sizeValue.textContent = this.value;
-    });
+    if (slider && sizeValue) {
+        slider.addEventListener('input', function() {
+            sizeValue.textContent = this.value;
+        });
+    }
     
     // Initialize radar canvas
     canvas = document.getElementById('radarCanvas');
     if (canvas) {
         ctx = canvas.getContext('2d');
+        initRadarLayers();
         drawRadar(); // Draw initial radar display
     }
 });
@@ -97,9 +115,7 @@ function stopRadar() {
             document.getElementById('angle-display').textContent = 'Servo: 90° | Radar: 0°';
             
             // Redraw radar
-            if (canvas && ctx) {
-                drawRadar();
-            }
+            requestRadarFrame();
         })
         .catch(error => {
             console.error('Error stopping radar:', error);
@@ -109,13 +125,31 @@ function stopRadar() {
 }
 
 function clearRadarData() {
-    radarData = [];
-    if (canvas && ctx) {
-        drawRadar();
+    radarDistances.fill(0);
+    radarDirtyFlags.fill(0);
+    radarDirtyCount = 0;
+    radarBinRects.fill(0);
+    if (pointsCtx) {
+        pointsCtx.clearRect(0, 0, pointsCanvas.width, pointsCanvas.height);
     }
+    renderedSweepAngle = -1;
+    requestRadarFrame();
     console.log('Radar data cleared');
 }
 
+// Store a sample in its angle bin; only bins whose value changed are queued for redraw
+function setRadarBin(angle, distance) {
+    const bin = Math.max(0, Math.min(RADAR_BINS - 1, Math.round(angle)));
+    if (radarDistances[bin] === distance) return;
+    
+    radarDistances[bin] = distance;
+    if (!radarDirtyFlags[bin]) {
+        radarDirtyFlags[bin] = 1;
+        radarDirtyBins[radarDirtyCount++] = bin;
+    }
+    requestRadarFrame();
+}
+
 // Fetch radar data from server
 function fetchRadarData() {
     if (!radarActive) return;
@@ -143,24 +177,16 @@ function fetchRadarData() {
                 objectStatus.style.color = '#ffff00';
             }
             
-            // Add valid data to radar array
+            // Store valid data in its angle bin (newest sample per degree wins)
             if (data.distance > 0) {
-                radarData.push({
-                    angle: data.angle,
-                    distance: data.distance
-                });
-                
-                // Keep only last 180 points (one full sweep)
-                if (radarData.length > 180) {
-                    radarData.shift();
-                }
+                setRadarBin(data.angle, data.distance);
             }
             
             // Update sweep angle
             sweepAngle = data.angle;
             
-            // Redraw radar
-            drawRadar();
+            // Redraw on next animation frame
+            requestRadarFrame();
             
             // Continue fetching if radar is active
             setTimeout(fetchRadarData, 100); // Fetch every 100ms
@@ -177,121 +203,224 @@ function fetchRadarData() {
         });
 }
 
-// Draw radar display
-function drawRadar() {
+// Create offscreen layers and draw the static background once
+function initRadarLayers() {
     if (!canvas || !ctx) return;
     
-    // Clear canvas
-    ctx.clearRect(0, 0, canvas.width, canvas.height);
+    radarCenterX = canvas.width / 2;
+    radarCenterY = canvas.height / 2;
+    radarMaxRadius = Math.min(radarCenterX, radarCenterY) - 20;
+    
+    bgCanvas = document.createElement('canvas');
+    bgCanvas.width = canvas.width;
+    bgCanvas.height = canvas.height;
+    drawRadarBackground(bgCanvas.getContext('2d'));
+    
+    pointsCanvas = document.createElement('canvas');
+    pointsCanvas.width = canvas.width;
+    pointsCanvas.height = canvas.height;
+    pointsCtx = pointsCanvas.getContext('2d');
+    
+    sweepGradient = ctx.createRadialGradient(radarCenterX, radarCenterY, 0, radarCenterX, radarCenterY, radarMaxRadius);
+    sweepGradient.addColorStop(0, 'rgba(0, 255, 0, 0.3)');
+    sweepGradient.addColorStop(1, 'rgba(0, 255, 0, 0)');
     
-    const centerX = canvas.width / 2;
-    const centerY = canvas.height / 2;
-    const maxRadius = Math.min(centerX, centerY) - 20;
+    // Bins may already hold data (e.g. layers rebuilt), queue them all
+    radarBinRects.fill(0);
+    for (let bin = 0; bin < RADAR_BINS; bin++) {
+        if (radarDistances[bin] > 0 && !radarDirtyFlags[bin]) {
+            radarDirtyFlags[bin] = 1;
+            radarDirtyBins[radarDirtyCount++] = bin;
+        }
+    }
+}
+
+// Schedule a single redraw on the next animation frame
+function requestRadarFrame() {
+    if (!ctx || radarFrameRequested) return;
+    radarFrameRequested = true;
+    requestAnimationFrame(renderRadarFrame);
+}
+
+function renderRadarFrame() {
+    radarFrameRequested = false;
+    
+    // Skip the frame if neither the sweep nor any bin has changed
+    if (radarDirtyCount === 0 && renderedSweepAngle === sweepAngle) return;
+    drawRadar();
+}
+
+// Draw radar display: blit cached layers, then the sweep line on top
+function drawRadar() {
+    if (!canvas || !ctx || !bgCanvas) return;
+    
+    // Update only the bins that changed since the last frame
+    updateRadarPoints();
+    
+    // Background is opaque, so it also clears the previous frame
+    ctx.drawImage(bgCanvas, 0, 0);
+    ctx.drawImage(pointsCanvas, 0, 0);
+    
+    // Draw sweep line
+    drawSweepLine();
+    renderedSweepAngle = sweepAngle;
+}
+
+// Draw static grid, labels and center point
+function drawRadarBackground(target) {
+    const width = target.canvas.width;
+    const height = target.canvas.height;
+    const centerX = radarCenterX;
+    const centerY = radarCenterY;
+    const maxRadius = radarMaxRadius;
     
     // Set styles
-    ctx.strokeStyle = '#00ff00';
-    ctx.fillStyle = '#001100';
-    ctx.lineWidth = 1;
+    target.strokeStyle = '#00ff00';
+    target.fillStyle = '#001100';
+    target.lineWidth = 1;
     
     // Fill background
-    ctx.fillRect(0, 0, canvas.width, canvas.height);
+    target.fillRect(0, 0, width, height);
     
     // Draw concentric circles (radar rings)
     for (let i = 1; i <= 4; i++) {
-        ctx.beginPath();
-        ctx.arc(centerX, centerY, (maxRadius / 4) * i, 0, 2 * Math.PI);
-        ctx.stroke();
+        target.beginPath();
+        target.arc(centerX, centerY, (maxRadius / 4) * i, 0, 2 * Math.PI);
+        target.stroke();
     }
     
     // Draw angle lines (9h-3h orientation: -90° to +90°)
-    ctx.strokeStyle = '#00ff00';
-    ctx.lineWidth = 1;
+    target.strokeStyle = '#00ff00';
+    target.lineWidth = 1;
     
     for (let angle = -90; angle <= 90; angle += 30) {
         const radian = (angle * Math.PI) / 180;
         const x = centerX + maxRadius * Math.cos(radian);
         const y = centerY + maxRadius * Math.sin(radian);
         
-        ctx.beginPath();
-        ctx.moveTo(centerX, centerY);
-        ctx.lineTo(x, y);
-        ctx.stroke();
+        target.beginPath();
+        target.moveTo(centerX, centerY);
+        target.lineTo(x, y);
+        target.stroke();
         
         // Draw angle labels
         const labelX = centerX + (maxRadius + 15) * Math.cos(radian);
         const labelY = centerY + (maxRadius + 15) * Math.sin(radian);
         
-        ctx.fillStyle = '#00ff00';
-        ctx.font = '10px Arial';
-        ctx.textAlign = 'center';
-        ctx.fillText(angle + '°', labelX, labelY);
+        target.fillStyle = '#00ff00';
+        target.font = '10px Arial';
+        target.textAlign = 'center';
+        target.fillText(angle + '°', labelX, labelY);
     }
     
     // Draw center point
-    ctx.fillStyle = '#ff0000';
-    ctx.beginPath();
-    ctx.arc(centerX, centerY, 3, 0, 2 * Math.PI);
-    ctx.fill();
+    target.fillStyle = '#ff0000';
+    target.beginPath();
+    target.arc(centerX, centerY, 3, 0, 2 * Math.PI);
+    target.fill();
     
     // Draw range labels
-    ctx.fillStyle = '#00ff00';
-    ctx.font = '10px Arial';
-    ctx.textAlign = 'center';
+    target.fillStyle = '#00ff00';
+    target.font = '10px Arial';
+    target.textAlign = 'center';
     
     for (let i = 1; i <= 4; i++) {
         const radius = (maxRadius / 4) * i;
         const distance = (i * 100); // Max range 400cm
-        ctx.fillText(distance + 'cm', centerX + radius, centerY - 5);
+        target.fillText(distance + 'cm', centerX + radius, centerY - 5);
     }
+}
+
+// Redraw changed bins on the points layer
+function updateRadarPoints() {
+    if (radarDirtyCount === 0) return;
     
-    // Draw radar data points
-    drawRadarData();
+    // Erase the previous drawing of every changed bin
+    for (let k = 0; k < radarDirtyCount; k++) {
+        const r = radarDirtyBins[k] * 4;
+        if (radarBinRects[r + 2] > 0) {
+            pointsCtx.clearRect(radarBinRects[r], radarBinRects[r + 1], radarBinRects[r + 2], radarBinRects[r + 3]);
+        }
+    }
     
-    // Draw sweep line
-    drawSweepLine();
+    // Repaint unchanged neighbours that overlapped an erased area, clipped to it
+    for (let k = 0; k < radarDirtyCount; k++) {
+        const r = radarDirtyBins[k] * 4;
+        const w = radarBinRects[r + 2];
+        if (w <= 0) continue;
+        
+        const x = radarBinRects[r], y = radarBinRects[r + 1], h = radarBinRects[r + 3];
+        pointsCtx.save();
+        pointsCtx.beginPath();
+        pointsCtx.rect(x, y, w, h);
+        pointsCtx.clip();
+        for (let bin = 0; bin < RADAR_BINS; bin++) {
+            const n = bin * 4;
+            if (radarDirtyFlags[bin] || radarBinRects[n + 2] <= 0) continue;
+            if (radarBinRects[n] < x + w && radarBinRects[n] + radarBinRects[n + 2] > x &&
+                radarBinRects[n + 1] < y + h && radarBinRects[n + 1] + radarBinRects[n + 3] > y) {
+                drawRadarPoint(pointsCtx, bin);
+            }
+        }
+        pointsCtx.restore();
+    }
+    
+    // Draw the new values
+    for (let k = 0; k < radarDirtyCount; k++) {
+        const bin = radarDirtyBins[k];
+        radarBinRects[bin * 4 + 2] = 0;
+        if (radarDistances[bin] > 0) {
+            drawRadarPoint(pointsCtx, bin);
+        }
+        radarDirtyFlags[bin] = 0;
+    }
+    radarDirtyCount = 0;
 }
 
-// Draw radar data points
-function drawRadarData() {
-    if (!canvas || !ctx) return;
+// Draw one radar data point and record its bounding box
+function drawRadarPoint(target, bin) {
+    // Convert servo angle (0-180°) to radar angle (-90° to +90°)
+    const radarAngle = bin - 90;
+    const radian = (radarAngle * Math.PI) / 180;
     
-    const centerX = canvas.width / 2;
-    const centerY = canvas.height / 2;
-    const maxRadius = Math.min(centerX, centerY) - 20;
+    // Calculate point position based on distance
+    const distance = Math.min(radarDistances[bin], RADAR_MAX_RANGE);
+    const pointRadius = (distance / RADAR_MAX_RANGE) * radarMaxRadius;
     
-    radarData.forEach(data => {
-        // Convert servo angle (0-180°) to radar angle (-90° to +90°)
-        const radarAngle = data.angle - 90;
-        const radian = (radarAngle * Math.PI) / 180;
-        
-        // Calculate point position based on distance
-        const distance = Math.min(data.distance, 400);
-        const pointRadius = (distance / 400) * maxRadius;
-        
-        const x = centerX + pointRadius * Math.cos(radian);
-        const y = centerY + pointRadius * Math.sin(radian);
-        
-        // Draw object point
-        ctx.fillStyle = '#ff0000';
-        ctx.beginPath();
-        ctx.arc(x, y, 3, 0, 2 * Math.PI);
-        ctx.fill();
-        
-        // Draw distance text
-        ctx.fillStyle = '#ffff00';
-        ctx.font = '8px Arial';
-        ctx.textAlign = 'center';
-        ctx.fillText(data.distance.toFixed(0) + 'cm', x, y - 8);
-    });
+    const x = radarCenterX + pointRadius * Math.cos(radian);
+    const y = radarCenterY + pointRadius * Math.sin(radian);
+    
+    // Draw object point
+    target.fillStyle = '#ff0000';
+    target.beginPath();
+    target.arc(x, y, 3, 0, 2 * Math.PI);
+    target.fill();
+    
+    // Draw distance text
+    const label = radarDistances[bin].toFixed(0) + 'cm';
+    target.fillStyle = '#ffff00';
+    target.font = '8px Arial';
+    target.textAlign = 'center';
+    target.fillText(label, x, y - 8);
+    
+    // Bounding box of dot and label, padded for anti-aliasing
+    const halfWidth = Math.max(4, target.measureText(label).width / 2 + 1);
+    const left = Math.floor(x - halfWidth);
+    const top = Math.floor(y - 18);
+    const r = bin * 4;
+    radarBinRects[r] = left;
+    radarBinRects[r + 1] = top;
+    radarBinRects[r + 2] = Math.ceil(x + halfWidth) - left;
+    radarBinRects[r + 3] = Math.ceil(y + 5) - top;
 }
 
 // Draw sweep line
 function drawSweepLine() {
     if (!canvas || !ctx) return;
     
-    const centerX = canvas.width / 2;
-    const centerY = canvas.height / 2;
-    const maxRadius = Math.min(centerX, centerY) - 20;
+    const centerX = radarCenterX;
+    const centerY = radarCenterY;
+    const maxRadius = radarMaxRadius;
     
     // Convert servo angle to radar angle
     const radarAngle = sweepAngle - 90;
@@ -309,14 +438,10 @@ function drawSweepLine() {
     ctx.stroke();
     
     // Draw fade effect for sweep
-    const gradient = ctx.createRadialGradient(centerX, centerY, 0, centerX, centerY, maxRadius);
-    gradient.addColorStop(0, 'rgba(0, 255, 0, 0.3)');
-    gradient.addColorStop(1, 'rgba(0, 255, 0, 0)');
-    
-    ctx.fillStyle = gradient;
+    ctx.fillStyle = sweepGradient;
     ctx.beginPath();
     ctx.moveTo(centerX, centerY);
     ctx.arc(centerX, centerY, maxRadius, radian - 0.1, radian + 0.1);
     ctx.closePath();
     ctx.fill();
-}
\ No newline at end of file
+}
@@ -414,6 +414,8 @@ class WebController {
         server.on("/", [this]() { handleFile("/index.html", "text/html"); });
         server.on("/style.css", [this]() { handleFile("/style.css", "text/css"); });
         server.on("/script.js", [this]() { handleFile("/script.js", "application/javascript"); });
+        server.on("/benchmark.html", [this]() { handleFile("/benchmark.html", "text/html"); });
+        server.on("/benchmark.js", [this]() { handleFile("/benchmark.js", "application/javascript"); });
         server.on("/cmd", [this]() { handleCmd(); });
         server.on("/square", [this]() { handleSquare(); });
         server.on("/servo", [this]() { handleServo(); });
@@ -428,6 +430,7 @@ class WebController {
         Serial.println("  GET /test-sr04 - Test SR04 sensor");
         Serial.println("  GET /distance - Get current distance");
         Serial.println("  GET /radar-data - Get radar data");
+        Serial.println("  GET /benchmark.html - Radar render benchmark");
     }
 
     void handleClient() {